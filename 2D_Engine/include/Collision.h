@@ -7,5 +7,21 @@ struct CollisionManifold {
     float penetration{0.f};
 };
 
+enum class ContactEventType {
+    Begin,   // pair started touching this step
+    Persist, // pair was already touching last step
+    End      // pair stopped touching (normal/penetration are last known values)
+};
+
+struct ContactEvent {
+    ContactEventType type{ContactEventType::Begin};
+    RigidBody* a{nullptr};
+    RigidBody* b{nullptr};
+    Vector2 normal{0.f, 0.f}; // from a to b
+    float penetration{0.f};
+    float impulse{0.f};       // normal impulse applied this step
+};
+
 CollisionManifold checkCollision(RigidBody& a, RigidBody& b);
-void resolveCollision(RigidBody& a, RigidBody& b, const CollisionManifold& m);
+// returns the magnitude of the normal impulse applied
+float resolveCollision(RigidBody& a, RigidBody& b, const CollisionManifold& m);
@@ -1,5 +1,6 @@
 #pragma once
 #include "Vector2.h"
+#include <cstddef>
 
 namespace Config {
     // pixels per second squared
@@ -7,4 +8,11 @@ namespace Config {
 
     // global restitution if needed as fallback
     static constexpr float DEFAULT_RESTITUTION = 0.2f;
+
+    // world area in pixels; bodies are clamped to it, particles culled well outside it
+    static constexpr float WORLD_WIDTH = 800.f;
+    static constexpr float WORLD_HEIGHT = 600.f;
+
+    // upper bound on live particles per ParticleSystem
+    static constexpr std::size_t MAX_PARTICLES = 1000000;
 }
@@ -0,0 +1,54 @@
+#pragma once
+#include <vector>
+#include "Vector2.h"
+#include "SpatialGrid.h"
+
+class RigidBody;
+
+enum class ForceFieldType {
+    Attractor, // pulls bodies towards position (negative strength repels), px/s^2
+    Wind,      // constant force along direction
+    Drag,      // linear drag coefficient, applied as exact exponential damping over dt
+    Explosion  // outward force with linear falloff, removed when lifetime runs out
+};
+
+// A force field acts on every body whose bounds overlap its circular region.
+struct ForceField {
+    ForceFieldType type{ForceFieldType::Wind};
+    Vector2 position{0.f, 0.f};
+    float radius{0.f};
+    float strength{0.f};
+    Vector2 direction{0.f, 0.f}; // wind only
+    float lifetime{-1.f};        // seconds left, negative = permanent
+
+    static ForceField attractor(const Vector2& pos, float radius, float strength);
+    static ForceField wind(const Vector2& pos, float radius, const Vector2& dir, float strength);
+    static ForceField drag(const Vector2& pos, float radius, float coefficient);
+    static ForceField explosion(const Vector2& pos, float radius, float strength, float duration = 0.1f);
+};
+
+class ForceFieldSystem {
+public:
+    using FieldId = unsigned int;
+
+    FieldId addField(const ForceField& field);
+    void removeField(FieldId id);
+    void clear();
+
+    // accumulates the force of every overlapping field into each body,
+    // then ages out expiring fields
+    void apply(const std::vector<RigidBody*>& bodies, float dt);
+
+    const std::vector<ForceField>& getFields() const { return fields; }
+
+private:
+    void rebuildIndex();
+
+    std::vector<ForceField> fields;
+    std::vector<FieldId> ids; // parallel to fields
+    FieldId nextId{0};
+    SpatialGrid index{128.f};          // local fields only
+    std::vector<int> globalFields;     // fields too large to index, checked by every body
+    bool indexDirty{false};
+    std::vector<int> candidates; // scratch, reused between bodies
+};
@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <SFML/Graphics.hpp>
+#include "Vector2.h"
+#include "Config.h"
+#include "StaticGrid.h"
+
+class World;
+
+// Cheap non-rigid particles (sparks, debris). Stored as parallel arrays so the
+// update loops run over contiguous floats; they fall under Config::gravity,
+// bounce one-way off the world's static bodies and never touch the rigid-body solver.
+// Particles that leave the world area (see Config) by a wide margin are dropped.
+class ParticleSystem {
+public:
+    explicit ParticleSystem(std::size_t capacity = Config::MAX_PARTICLES);
+
+    void emit(const Vector2& pos, const Vector2& vel, float lifetime, const sf::Color& color);
+    // count particles from pos in random directions, speeds up to maxSpeed
+    void burst(const Vector2& pos, std::size_t count, float maxSpeed, float lifetime, const sf::Color& color);
+
+    void update(float dt, const World& world);
+    void render(sf::RenderWindow& window) const; // single batched point draw
+    void clear();
+
+    std::size_t size() const { return posX.size(); }
+    float restitution{0.3f};
+
+private:
+    void integrate(float dt, StaticGrid::Locator cellAt);
+    void collide(const StaticGrid& grid);
+    void removeDead();
+
+    std::size_t capacity;
+    std::vector<float> posX, posY;
+    std::vector<float> velX, velY;
+    std::vector<float> life;
+    std::vector<sf::Color> color;
+
+    std::vector<unsigned int> particleCell; // static grid cell of each particle this step
+    std::vector<unsigned int> nearStatic;   // particles in occupied cells this step
+    mutable std::vector<sf::Vertex> vertices;
+};
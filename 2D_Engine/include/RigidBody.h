@@ -1,6 +1,7 @@
 #pragma once
 #include "Vector2.h"
 #include "Shape.h"
+#include "Config.h"
 #include <memory>
 
 class RigidBody
@@ -11,16 +12,18 @@ public:
     float restitution; // 0..1
     Vector2 velocity{0.f, 0.f};
     Vector2 acceleration{0.f, 0.f};
+    Vector2 force{0.f, 0.f}; // accumulated over one step, cleared by update
     bool isStatic{false};
-    bool isColliding{false};
 
     RigidBody(std::shared_ptr<Shape> s, float m, float r = Config::DEFAULT_RESTITUTION, bool isStatic_ = false);
 
-    void applyForce(const Vector2& force);
+    void applyForce(const Vector2& f);
     void applyImpulse(const Vector2& impulse);
     void update(float dt);
+    void clearForces() { force = {0.f, 0.f}; }
 
     Vector2 getPosition() const { return shape->getPosition(); }
     void setPosition(const Vector2& p) { shape->setPosition(p); }
     ShapeType getShapeType() const { return shape->getType(); }
+    void getBounds(Vector2& min, Vector2& max) const; // world-space AABB
 };
@@ -2,6 +2,7 @@
 #include <string>
 #include <vector>
 #include "World.h"
+#include "ParticleSystem.h"
 
 class Scene {
 public:
@@ -12,10 +13,12 @@ public:
     void update(float dt);
     void clear();             // remove bodies (but not delete pointers)
     World& getWorld() { return world; }
+    ParticleSystem& getParticles() { return particles; }
     const std::string& getName() const { return name; }
 
 private:
     std::string name;
     World world;
+    ParticleSystem particles;
     std::vector<RigidBody*> ownedBodies; // memory owned by scene; deleted in dtor
 };
@@ -0,0 +1,26 @@
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include "Vector2.h"
+
+// Uniform hash grid over axis-aligned bounds. Stores integer ids so callers
+// keep their own arrays and just use the grid to narrow down candidates.
+class SpatialGrid {
+public:
+    explicit SpatialGrid(float cellSize = 64.f);
+
+    void clear();
+    void insert(int id, const Vector2& min, const Vector2& max);
+    // appends every id whose cells overlap [min, max] (each id at most once)
+    void query(const Vector2& min, const Vector2& max, std::vector<int>& out) const;
+    bool empty() const { return cells.empty(); }
+    float getCellSize() const { return cellSize; }
+
+private:
+    static unsigned long long cellKey(int cx, int cy);
+    int cellCoord(float v) const;
+
+    float cellSize;
+    int minX{0}, minY{0}, maxX{-1}, maxY{-1}; // cell range covered by inserted bounds
+    std::unordered_map<unsigned long long, std::vector<int>> cells;
+};
@@ -0,0 +1,67 @@
+#pragma once
+#include <vector>
+#include "Vector2.h"
+
+class RigidBody;
+
+// Dense cell table over a World's static bodies, rebuilt whenever one is added.
+// Each cell holds copies of the collision data of the bodies overlapping it, so
+// per-point lookups (particles) touch one contiguous range.
+class StaticGrid {
+public:
+    struct Entry {
+        RigidBody* body;
+        bool circle;
+        Vector2 min, max; // AABB
+        Vector2 center;
+        float radius;     // circles only
+    };
+
+    StaticGrid();
+
+    void add(RigidBody* body);
+    // static bodies whose cells overlap [min, max], each once
+    void query(const Vector2& min, const Vector2& max, std::vector<RigidBody*>& out) const;
+    bool empty() const { return bodies.empty(); }
+
+    // maps a point to its cell, or to emptyCell() outside the table, without branching;
+    // copy it into a local in hot loops so its fields stay in registers
+    struct Locator {
+        Vector2 origin;
+        float invCellSize{1.f};
+        float cols{0.f}, rows{0.f}, lastCol{0.f}, lastRow{0.f};
+        unsigned int stride{0}, emptyCell{0};
+
+        unsigned int operator()(float x, float y) const {
+            float fx = (x - origin.x) * invCellSize;
+            float fy = (y - origin.y) * invCellSize;
+            unsigned int outside = !((fx >= 0.f) & (fy >= 0.f) & (fx < cols) & (fy < rows));
+            fx = fx > 0.f ? fx : 0.f;
+            fy = fy > 0.f ? fy : 0.f;
+            unsigned int cx = static_cast<unsigned int>(static_cast<int>(fx < lastCol ? fx : lastCol));
+            unsigned int cy = static_cast<unsigned int>(static_cast<int>(fy < lastRow ? fy : lastRow));
+            unsigned int c = cy * stride + cx;
+            return c + (emptyCell - c) * outside;
+        }
+    };
+
+    const Locator& getLocator() const { return locator; }
+    unsigned int emptyCell() const { return cols * rows; }
+    // 1 if any body overlaps the cell, indexable up to and including emptyCell()
+    const unsigned char* occupancy() const { return occupied.data(); }
+    const Entry* cellBegin(unsigned int c) const { return cellEntries.data() + cellStart[c]; }
+    const Entry* cellEnd(unsigned int c) const { return cellEntries.data() + cellStart[c + 1]; }
+
+private:
+    void rebuild();
+    void cellRange(const Entry& e, int& x0, int& y0, int& x1, int& y1) const;
+
+    std::vector<Entry> bodies;
+    Vector2 origin;
+    float invCellSize{1.f};
+    unsigned int cols{0}, rows{0};
+    Locator locator;
+    std::vector<unsigned int> cellStart; // offsets into cellEntries, cols*rows + 2 entries
+    std::vector<Entry> cellEntries;      // grouped by cell
+    std::vector<unsigned char> occupied; // cols*rows + 1 entries, the last one empty
+};
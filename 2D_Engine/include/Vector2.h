@@ -8,6 +8,7 @@ struct Vector2 {
 
     Vector2 operator+(const Vector2& v) const { return {x + v.x, y + v.y}; }
     Vector2 operator-(const Vector2& v) const { return {x - v.x, y - v.y}; }
+    Vector2 operator-() const { return {-x, -y}; }
     Vector2 operator*(float s) const { return {x * s, y * s}; }
     Vector2 operator/(float s) const { return {x / s, y / s}; }
 
@@ -1,14 +1,40 @@
 #pragma once
 #include <vector>
 #include "RigidBody.h"
+#include "Collision.h"
+#include "ForceField.h"
+#include "StaticGrid.h"
 
 class World
 {
 public:
+    // Static bodies are copied into the static grid here, so set isStatic, shape and
+    // position before adding them and don't move them afterwards.
     void addRigidBody(RigidBody* body);
     void update(float dt);
     const std::vector<RigidBody*>& getBodies() const { return bodies; }
+    ForceFieldSystem& getForceFields() { return forceFields; }
+
+    // begin/persist/end events produced by the last update, one per changed or touching pair
+    const std::vector<ContactEvent>& getContactEvents() const { return contactEvents; }
+
+    // static bodies whose bounds overlap [min, max], looked up in the static broadphase grid
+    void queryStatic(const Vector2& min, const Vector2& max, std::vector<RigidBody*>& out) const;
+    const StaticGrid& getStaticGrid() const { return staticGrid; }
 
 private:
+    // touching pair keyed by body indices (i < j) so both steps sort the same way
+    struct ContactPair {
+        unsigned long long key;
+        ContactEvent contact;
+    };
+
+    void buildContactEvents();
+
     std::vector<RigidBody*> bodies;
+    ForceFieldSystem forceFields;
+    StaticGrid staticGrid; // static bodies as they were added (see addRigidBody)
+    std::vector<ContactPair> contacts;         // this step, sorted by key
+    std::vector<ContactPair> previousContacts; // last step, sorted by key
+    std::vector<ContactEvent> contactEvents;
 };
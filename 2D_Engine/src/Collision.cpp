@@ -75,16 +75,21 @@ static CollisionManifold circleVsRect(RigidBody& a, RigidBody& b) {
         float dist = std::sqrt(distSq);
         m.colliding = true;
         if (dist > 0.f) {
-            m.normal = diff / dist; // from rect to circle
+            m.normal = diff / -dist; // from circle to rect
             m.penetration = radius - dist;
         } else {
-            // center exactly on edge/inside; choose a normal based on direction
-            Vector2 dir = (circlePos - rectPos).normalized();
-            m.normal = dir.length() > 0 ? dir : Vector2(1.f, 0.f);
-            // compute penetration along the minor overlap axis:
-            float overlapX = radius + half.x - std::abs(circlePos.x - rectPos.x);
-            float overlapY = radius + half.y - std::abs(circlePos.y - rectPos.y);
-            m.penetration = std::min(overlapX, overlapY);
+            // center on edge/inside; push out along the axis of least overlap
+            float dx = circlePos.x - rectPos.x;
+            float dy = circlePos.y - rectPos.y;
+            float overlapX = radius + half.x - std::abs(dx);
+            float overlapY = radius + half.y - std::abs(dy);
+            if (overlapX < overlapY) {
+                m.normal = Vector2(dx < 0 ? 1.f : -1.f, 0.f);
+                m.penetration = overlapX;
+            } else {
+                m.normal = Vector2(0.f, dy < 0 ? 1.f : -1.f);
+                m.penetration = overlapY;
+            }
         }
     }
     return m;
@@ -103,8 +108,7 @@ CollisionManifold checkCollision(RigidBody& a, RigidBody& b) {
     if (A == ShapeType::Rectangle && B == ShapeType::Circle) {
         CollisionManifold m = circleVsRect(b, a);
         if (m.colliding) {
-            // normal currently points from rect to circle (because we called circleVsRect with circle=b)
-            // but we must invert normal to be from a -> b
+            // circleVsRect gives circle -> rect, i.e. b -> a here; invert to a -> b
             m.normal = m.normal * -1.f;
         }
         return m;
@@ -112,8 +116,8 @@ CollisionManifold checkCollision(RigidBody& a, RigidBody& b) {
     return {};
 }
 
-void resolveCollision(RigidBody& a, RigidBody& b, const CollisionManifold& m) {
-    if (!m.colliding) return;
+float resolveCollision(RigidBody& a, RigidBody& b, const CollisionManifold& m) {
+    if (!m.colliding) return 0.f;
 
     // positional correction
     const float percent = 0.8f; // positional correction percentage
@@ -133,17 +137,18 @@ void resolveCollision(RigidBody& a, RigidBody& b, const CollisionManifold& m) {
     // relative velocity
     Vector2 rv = b.velocity - a.velocity;
     float velAlongNormal = rv.dot(m.normal);
-    if (velAlongNormal > 0) return;
+    if (velAlongNormal > 0) return 0.f;
 
     float e = std::min(a.restitution, b.restitution);
     float j = -(1 + e) * velAlongNormal;
     float invMassA = a.isStatic ? 0.f : 1.f / a.mass;
     float invMassB = b.isStatic ? 0.f : 1.f / b.mass;
     float denom = invMassA + invMassB;
-    if (denom == 0.f) return;
+    if (denom == 0.f) return 0.f;
     j /= denom;
 
     Vector2 impulse = m.normal * j;
     if (!a.isStatic) a.applyImpulse(-impulse);
     if (!b.isStatic) b.applyImpulse(impulse);
+    return j;
 }
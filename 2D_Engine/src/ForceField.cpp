@@ -0,0 +1,174 @@
+#include "ForceField.h"
+#include "RigidBody.h"
+#include <algorithm>
+#include <cmath>
+
+ForceField ForceField::attractor(const Vector2& pos, float radius, float strength)
+{
+    ForceField f;
+    f.type = ForceFieldType::Attractor;
+    f.position = pos;
+    f.radius = radius;
+    f.strength = strength;
+    return f;
+}
+
+ForceField ForceField::wind(const Vector2& pos, float radius, const Vector2& dir, float strength)
+{
+    ForceField f;
+    f.type = ForceFieldType::Wind;
+    f.position = pos;
+    f.radius = radius;
+    f.direction = dir.normalized();
+    f.strength = strength;
+    return f;
+}
+
+ForceField ForceField::drag(const Vector2& pos, float radius, float coefficient)
+{
+    ForceField f;
+    f.type = ForceFieldType::Drag;
+    f.position = pos;
+    f.radius = radius;
+    f.strength = coefficient;
+    return f;
+}
+
+ForceField ForceField::explosion(const Vector2& pos, float radius, float strength, float duration)
+{
+    ForceField f;
+    f.type = ForceFieldType::Explosion;
+    f.position = pos;
+    f.radius = radius;
+    f.strength = strength;
+    f.lifetime = duration;
+    return f;
+}
+
+ForceFieldSystem::FieldId ForceFieldSystem::addField(const ForceField& field)
+{
+    fields.push_back(field);
+    ids.push_back(nextId);
+    indexDirty = true;
+    return nextId++;
+}
+
+void ForceFieldSystem::removeField(FieldId id)
+{
+    auto it = std::find(ids.begin(), ids.end(), id);
+    if (it == ids.end()) return;
+    size_t i = static_cast<size_t>(it - ids.begin());
+    fields[i] = fields.back();
+    ids[i] = ids.back();
+    fields.pop_back();
+    ids.pop_back();
+    indexDirty = true;
+}
+
+void ForceFieldSystem::clear()
+{
+    fields.clear();
+    ids.clear();
+    index.clear();
+    globalFields.clear();
+    indexDirty = false;
+}
+
+// fields spanning more cells than this per axis skip the grid; a scene-wide
+// wind or drag zone would otherwise fill millions of buckets on every rebuild
+static constexpr float kMaxIndexedCells = 16.f;
+
+void ForceFieldSystem::rebuildIndex()
+{
+    index.clear();
+    globalFields.clear();
+    for (size_t i = 0; i < fields.size(); ++i) {
+        const ForceField& f = fields[i];
+        if (2.f * f.radius > kMaxIndexedCells * index.getCellSize()) {
+            globalFields.push_back(static_cast<int>(i));
+            continue;
+        }
+        Vector2 r{f.radius, f.radius};
+        index.insert(static_cast<int>(i), f.position - r, f.position + r);
+    }
+    indexDirty = false;
+}
+
+// force of a single field on a body; the caller has already checked overlap.
+// Drag is summed separately by the caller, see apply().
+static Vector2 evaluate(const ForceField& f, const RigidBody& b, const Vector2& pos)
+{
+    switch (f.type) {
+    case ForceFieldType::Attractor: {
+        Vector2 dir = (f.position - pos).normalized();
+        return dir * (f.strength * b.mass);
+    }
+    case ForceFieldType::Wind:
+        return f.direction * f.strength;
+    case ForceFieldType::Drag:
+        return {};
+    case ForceFieldType::Explosion: {
+        Vector2 diff = pos - f.position;
+        float dist = diff.length();
+        float falloff = 1.f - std::min(dist / f.radius, 1.f);
+        Vector2 dir = dist > 0.f ? diff / dist : Vector2(0.f, -1.f);
+        return dir * (f.strength * falloff);
+    }
+    }
+    return {};
+}
+
+// remaining lifetime below this counts as expired, so float drift can't add a step
+static constexpr float kLifetimeEpsilon = 1e-5f;
+
+void ForceFieldSystem::apply(const std::vector<RigidBody*>& bodies, float dt)
+{
+    if (fields.empty()) return;
+    if (indexDirty) rebuildIndex();
+
+    for (auto* b : bodies) {
+        if (b->isStatic) continue;
+
+        Vector2 bmin, bmax;
+        b->getBounds(bmin, bmax);
+        candidates.assign(globalFields.begin(), globalFields.end());
+        index.query(bmin, bmax, candidates);
+        if (candidates.empty()) continue;
+
+        Vector2 pos = b->getPosition();
+        float dragK = 0.f;
+        for (int i : candidates) {
+            const ForceField& f = fields[i];
+            // circle vs body AABB
+            float cx = std::clamp(f.position.x, bmin.x, bmax.x);
+            float cy = std::clamp(f.position.y, bmin.y, bmax.y);
+            Vector2 d{f.position.x - cx, f.position.y - cy};
+            if (d.dot(d) > f.radius * f.radius) continue;
+            if (f.type == ForceFieldType::Drag) { dragK += f.strength; continue; }
+            Vector2 force = evaluate(f, *b, pos);
+            // a timed field only pushes for what is left of its lifetime, so the
+            // total impulse doesn't depend on dt
+            if (f.lifetime >= 0.f && dt > 0.f) force = force * (std::min(f.lifetime, dt) / dt);
+            b->applyForce(force);
+        }
+
+        // -k*v under explicit Euler overshoots once k*dt/m > 2, so instead pick
+        // the force that gives the exact decay v * exp(-k*dt/m) over this step
+        if (dragK > 0.f && dt > 0.f) {
+            float damp = 1.f - std::exp(-dragK * dt / b->mass);
+            b->applyForce(b->velocity * (-damp * b->mass / dt));
+        }
+    }
+
+    // age out timed fields (explosions)
+    for (size_t i = 0; i < fields.size();) {
+        if (fields[i].lifetime >= 0.f) {
+            fields[i].lifetime -= dt;
+            if (fields[i].lifetime <= kLifetimeEpsilon) {
+                removeField(ids[i]);
+                continue;
+            }
+        }
+        ++i;
+    }
+}
@@ -0,0 +1,189 @@
+#include "ParticleSystem.h"
+#include "World.h"
+#include "Utils.h"
+#include <algorithm>
+#include <cmath>
+
+// lanes per batch; the fixed inner trip count lets the compiler emit SIMD for it
+static constexpr std::size_t kBatch = 8;
+// particles this far below or beside the world never come back, so they are dropped
+static constexpr float kCullMargin = 200.f;
+
+ParticleSystem::ParticleSystem(std::size_t capacity_) : capacity(capacity_) {}
+
+void ParticleSystem::emit(const Vector2& pos, const Vector2& vel, float lifetime, const sf::Color& c)
+{
+    if (posX.size() >= capacity) return;
+    posX.push_back(pos.x);
+    posY.push_back(pos.y);
+    velX.push_back(vel.x);
+    velY.push_back(vel.y);
+    life.push_back(lifetime);
+    color.push_back(c);
+}
+
+void ParticleSystem::burst(const Vector2& pos, std::size_t count, float maxSpeed, float lifetime, const sf::Color& c)
+{
+    const float twoPi = 6.2831853f;
+    for (std::size_t i = 0; i < count; ++i) {
+        float angle = Utils::randomFloat(0.f, twoPi);
+        float speed = Utils::randomFloat(0.f, maxSpeed);
+        float l = lifetime * Utils::randomFloat(0.5f, 1.f);
+        emit(pos, {std::cos(angle) * speed, std::sin(angle) * speed}, l, c);
+    }
+}
+
+void ParticleSystem::clear()
+{
+    posX.clear(); posY.clear();
+    velX.clear(); velY.clear();
+    life.clear();
+    color.clear();
+}
+
+void ParticleSystem::update(float dt, const World& world)
+{
+    if (posX.empty()) return;
+    const StaticGrid& grid = world.getStaticGrid();
+    integrate(dt, grid.getLocator());
+    if (!grid.empty()) collide(grid);
+    removeDead();
+}
+
+// also records each particle's static grid cell, for collide
+void ParticleSystem::integrate(float dt, StaticGrid::Locator cellAt)
+{
+    const std::size_t n = posX.size();
+    particleCell.resize(n);
+    unsigned int* cell = particleCell.data();
+    float* px = posX.data();
+    float* py = posY.data();
+    float* vx = velX.data();
+    float* vy = velY.data();
+    float* lf = life.data();
+    const float gx = Config::gravity.x * dt;
+    const float gy = Config::gravity.y * dt;
+
+    // update each batch in local lanes so the arithmetic is alias-free
+    std::size_t i = 0;
+    for (; i + kBatch <= n; i += kBatch) {
+        float x[kBatch], y[kBatch], u[kBatch], v[kBatch], l[kBatch];
+        unsigned int c[kBatch];
+        for (std::size_t k = 0; k < kBatch; ++k) {
+            x[k] = px[i+k]; y[k] = py[i+k];
+            u[k] = vx[i+k]; v[k] = vy[i+k];
+            l[k] = lf[i+k];
+        }
+        for (std::size_t k = 0; k < kBatch; ++k) {
+            u[k] += gx; v[k] += gy;
+            x[k] += u[k] * dt; y[k] += v[k] * dt;
+            l[k] -= dt;
+            c[k] = cellAt(x[k], y[k]);
+        }
+        for (std::size_t k = 0; k < kBatch; ++k) {
+            px[i+k] = x[k]; py[i+k] = y[k];
+            vx[i+k] = u[k]; vy[i+k] = v[k];
+            lf[i+k] = l[k];
+            cell[i+k] = c[k];
+        }
+    }
+    for (; i < n; ++i) {
+        vx[i] += gx; vy[i] += gy;
+        px[i] += vx[i] * dt; py[i] += vy[i] * dt;
+        lf[i] -= dt;
+        cell[i] = cellAt(px[i], py[i]);
+    }
+}
+
+// one-way: particles are pushed out of static bodies and bounce, bodies are unaffected
+void ParticleSystem::collide(const StaticGrid& grid)
+{
+    const std::size_t n = posX.size();
+    float* px = posX.data();
+    float* py = posY.data();
+    float* vx = velX.data();
+    float* vy = velY.data();
+    const float e = restitution;
+
+    const unsigned int* cellOf = particleCell.data();
+
+    // gather the particles whose cell lists any static body, without branching
+    nearStatic.resize(n);
+    unsigned int* gathered = nearStatic.data();
+    const unsigned char* occupied = grid.occupancy();
+    std::size_t m = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        gathered[m] = static_cast<unsigned int>(i);
+        m += occupied[cellOf[i]];
+    }
+
+    // then test each gathered particle against the static bodies in its cell
+    for (std::size_t c = 0; c < m; ++c) {
+        unsigned int i = nearStatic[c];
+        unsigned int cell = cellOf[i];
+
+        for (const StaticGrid::Entry* s = grid.cellBegin(cell); s != grid.cellEnd(cell); ++s) {
+            if (s->circle) {
+                float dx = px[i] - s->center.x, dy = py[i] - s->center.y;
+                float d2 = dx*dx + dy*dy;
+                if (d2 >= s->radius*s->radius || d2 == 0.f) continue;
+                float d = std::sqrt(d2);
+                float nx = dx / d, ny = dy / d;
+                px[i] = s->center.x + nx * s->radius;
+                py[i] = s->center.y + ny * s->radius;
+                float vn = vx[i]*nx + vy[i]*ny;
+                if (vn < 0.f) {
+                    vx[i] -= nx * (1.f + e) * vn;
+                    vy[i] -= ny * (1.f + e) * vn;
+                }
+            } else {
+                float x = px[i], y = py[i];
+                if (x <= s->min.x || x >= s->max.x || y <= s->min.y || y >= s->max.y) continue;
+                // push out through the nearest face
+                float left = x - s->min.x, right = s->max.x - x;
+                float top = y - s->min.y, bottom = s->max.y - y;
+                float nearest = std::min(std::min(left, right), std::min(top, bottom));
+                if (nearest == top)         { py[i] = s->min.y; if (vy[i] > 0.f) vy[i] *= -e; }
+                else if (nearest == bottom) { py[i] = s->max.y; if (vy[i] < 0.f) vy[i] *= -e; }
+                else if (nearest == left)   { px[i] = s->min.x; if (vx[i] > 0.f) vx[i] *= -e; }
+                else                        { px[i] = s->max.x; if (vx[i] < 0.f) vx[i] *= -e; }
+            }
+        }
+    }
+}
+
+// swap-remove expired or escaped particles; order is not preserved
+void ParticleSystem::removeDead()
+{
+    const float left = -kCullMargin, right = Config::WORLD_WIDTH + kCullMargin;
+    const float bottom = Config::WORLD_HEIGHT + kCullMargin;
+    std::size_t n = posX.size();
+    for (std::size_t i = 0; i < n;) {
+        bool inside = posX[i] > left && posX[i] < right && posY[i] < bottom;
+        if (life[i] > 0.f && inside) { ++i; continue; }
+        --n;
+        posX[i] = posX[n]; posY[i] = posY[n];
+        velX[i] = velX[n]; velY[i] = velY[n];
+        life[i] = life[n];
+        color[i] = color[n];
+    }
+    posX.resize(n); posY.resize(n);
+    velX.resize(n); velY.resize(n);
+    life.resize(n);
+    color.resize(n);
+}
+
+void ParticleSystem::render(sf::RenderWindow& window) const
+{
+    const std::size_t n = posX.size();
+    if (n == 0) return;
+    vertices.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        sf::Vertex& v = vertices[i];
+        v.position = sf::Vector2f(posX[i], posY[i]);
+        v.color = color[i];
+        // fade out over the last second
+        if (life[i] < 1.f) v.color.a = static_cast<sf::Uint8>(v.color.a * life[i]);
+    }
+    window.draw(vertices.data(), n, sf::Points);
+}
@@ -6,14 +6,11 @@ RigidBody::RigidBody(std::shared_ptr<Shape> s, float m, float r, bool isStatic_)
 {
     if (mass <= 0.f) mass = 1.f;
 }
-void RigidBody::applyForce(const Vector2& force)
+void RigidBody::applyForce(const Vector2& f)
 {
     if (isStatic) return;
-    // accumulate as acceleration contribution via update
-    // We'll use a simple approach: treat as immediate impulse scaled by dt in update
-    // For clarity we keep forces per-frame style using a local static container in update.
-    // But to keep API, just convert to velocity change proportionally (simple).
-    velocity += force / mass;
+    // accumulated until the next update, which integrates it over dt
+    force += f;
 }
 
 void RigidBody::applyImpulse(const Vector2& impulse)
@@ -25,10 +22,26 @@ void RigidBody::applyImpulse(const Vector2& impulse)
 void RigidBody::update(float dt)
 {
     if (!isStatic) {
-        // apply gravity
-        acceleration = Config::gravity;
+        // gravity plus whatever forces were applied this step (F = m * a)
+        acceleration = Config::gravity + force / mass;
         velocity += acceleration * dt;
         Vector2 newPos = shape->getPosition() + velocity * dt;
         shape->setPosition(newPos);
     }
+    clearForces();
+}
+
+void RigidBody::getBounds(Vector2& min, Vector2& max) const
+{
+    Vector2 pos = getPosition();
+    Vector2 half;
+    if (getShapeType() == ShapeType::Circle) {
+        float r = shape->getBoundingRadius();
+        half = {r, r};
+    } else {
+        sf::Vector2f h = shape->getHalfExtents();
+        half = {h.x, h.y};
+    }
+    min = pos - half;
+    max = pos + half;
 }
@@ -45,6 +45,7 @@ void Scene::init() {
 
 void Scene::update(float dt) {
     world.update(dt);
+    particles.update(dt, world);
 }
 
 void Scene::clear() {
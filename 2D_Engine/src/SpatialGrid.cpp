@@ -0,0 +1,62 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(float cellSize_) : cellSize(cellSize_)
+{
+    if (cellSize <= 0.f) cellSize = 64.f;
+}
+
+void SpatialGrid::clear()
+{
+    cells.clear();
+    minX = minY = 0;
+    maxX = maxY = -1;
+}
+
+unsigned long long SpatialGrid::cellKey(int cx, int cy)
+{
+    // go through unsigned so negative coordinates pack without shifting a signed value
+    return (static_cast<unsigned long long>(static_cast<unsigned int>(cx)) << 32)
+         | static_cast<unsigned int>(cy);
+}
+
+int SpatialGrid::cellCoord(float v) const
+{
+    // clamp before converting so far-off coordinates can't overflow the int
+    const float limit = 1 << 30;
+    return static_cast<int>(std::max(-limit, std::min(std::floor(v / cellSize), limit)));
+}
+
+void SpatialGrid::insert(int id, const Vector2& min, const Vector2& max)
+{
+    int x0 = cellCoord(min.x), x1 = cellCoord(max.x);
+    int y0 = cellCoord(min.y), y1 = cellCoord(max.y);
+    if (cells.empty()) {
+        minX = x0; minY = y0; maxX = x1; maxY = y1;
+    } else {
+        minX = std::min(minX, x0); minY = std::min(minY, y0);
+        maxX = std::max(maxX, x1); maxY = std::max(maxY, y1);
+    }
+    for (int cx = x0; cx <= x1; ++cx)
+        for (int cy = y0; cy <= y1; ++cy)
+            cells[cellKey(cx, cy)].push_back(id);
+}
+
+void SpatialGrid::query(const Vector2& min, const Vector2& max, std::vector<int>& out) const
+{
+    if (cells.empty()) return;
+    size_t first = out.size();
+    // only visit cells that something was inserted into, however large the query
+    int x0 = std::max(cellCoord(min.x), minX), x1 = std::min(cellCoord(max.x), maxX);
+    int y0 = std::max(cellCoord(min.y), minY), y1 = std::min(cellCoord(max.y), maxY);
+    for (int cx = x0; cx <= x1; ++cx) {
+        for (int cy = y0; cy <= y1; ++cy) {
+            auto it = cells.find(cellKey(cx, cy));
+            if (it != cells.end()) out.insert(out.end(), it->second.begin(), it->second.end());
+        }
+    }
+    // an id spanning several cells shows up once per cell
+    std::sort(out.begin() + first, out.end());
+    out.erase(std::unique(out.begin() + first, out.end()), out.end());
+}
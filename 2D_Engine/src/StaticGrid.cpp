@@ -0,0 +1,102 @@
+#include "StaticGrid.h"
+#include "RigidBody.h"
+#include <algorithm>
+#include <cmath>
+
+// smallest cell edge, and cap on cells per axis (cells grow for wide layouts)
+static constexpr float kMinCellSize = 8.f;
+static constexpr float kMaxCellsPerAxis = 256.f;
+
+StaticGrid::StaticGrid()
+{
+    rebuild();
+}
+
+void StaticGrid::add(RigidBody* body)
+{
+    Entry e;
+    e.body = body;
+    body->getBounds(e.min, e.max);
+    e.circle = body->getShapeType() == ShapeType::Circle;
+    e.center = body->getPosition();
+    e.radius = body->shape->getBoundingRadius();
+    bodies.push_back(e);
+    rebuild();
+}
+
+void StaticGrid::cellRange(const Entry& e, int& x0, int& y0, int& x1, int& y1) const
+{
+    x0 = static_cast<int>(std::floor((e.min.x - origin.x) * invCellSize));
+    y0 = static_cast<int>(std::floor((e.min.y - origin.y) * invCellSize));
+    x1 = std::min(static_cast<int>(std::floor((e.max.x - origin.x) * invCellSize)), static_cast<int>(cols) - 1);
+    y1 = std::min(static_cast<int>(std::floor((e.max.y - origin.y) * invCellSize)), static_cast<int>(rows) - 1);
+}
+
+void StaticGrid::rebuild()
+{
+    cols = rows = 0;
+    if (!bodies.empty()) {
+        Vector2 lo = bodies[0].min, hi = bodies[0].max;
+        for (const auto& e : bodies) {
+            lo = {std::min(lo.x, e.min.x), std::min(lo.y, e.min.y)};
+            hi = {std::max(hi.x, e.max.x), std::max(hi.y, e.max.y)};
+        }
+        float extent = std::max(hi.x - lo.x, hi.y - lo.y);
+        float cellSize = std::max(kMinCellSize, extent / kMaxCellsPerAxis);
+        origin = lo;
+        invCellSize = 1.f / cellSize;
+        cols = static_cast<unsigned int>((hi.x - lo.x) * invCellSize) + 1;
+        rows = static_cast<unsigned int>((hi.y - lo.y) * invCellSize) + 1;
+    }
+    locator.origin = origin;
+    locator.invCellSize = invCellSize;
+    locator.cols = static_cast<float>(cols);
+    locator.rows = static_cast<float>(rows);
+    locator.lastCol = locator.cols - 1.f;
+    locator.lastRow = locator.rows - 1.f;
+    locator.stride = cols;
+    locator.emptyCell = emptyCell();
+
+    // count, prefix sum, fill; the extra cell past the grid stays empty
+    cellStart.assign(static_cast<std::size_t>(cols) * rows + 2, 0);
+    for (const auto& e : bodies) {
+        int x0, y0, x1, y1;
+        cellRange(e, x0, y0, x1, y1);
+        for (int cy = y0; cy <= y1; ++cy)
+            for (int cx = x0; cx <= x1; ++cx) ++cellStart[static_cast<std::size_t>(cy) * cols + cx + 1];
+    }
+    for (std::size_t c = 1; c < cellStart.size(); ++c) cellStart[c] += cellStart[c - 1];
+
+    std::vector<unsigned int> fill(cellStart.begin(), cellStart.end() - 1);
+    cellEntries.resize(cellStart.back());
+    for (const auto& e : bodies) {
+        int x0, y0, x1, y1;
+        cellRange(e, x0, y0, x1, y1);
+        for (int cy = y0; cy <= y1; ++cy)
+            for (int cx = x0; cx <= x1; ++cx) cellEntries[fill[static_cast<std::size_t>(cy) * cols + cx]++] = e;
+    }
+
+    occupied.resize(cellStart.size() - 1);
+    for (std::size_t c = 0; c < occupied.size(); ++c) occupied[c] = cellStart[c] != cellStart[c + 1];
+}
+
+void StaticGrid::query(const Vector2& min, const Vector2& max, std::vector<RigidBody*>& out) const
+{
+    if (cols == 0) return;
+    // clamp in float space first so far-away bounds can't overflow the int conversion
+    float fx0 = std::max((min.x - origin.x) * invCellSize, 0.f);
+    float fy0 = std::max((min.y - origin.y) * invCellSize, 0.f);
+    float fx1 = std::min((max.x - origin.x) * invCellSize, locator.lastCol);
+    float fy1 = std::min((max.y - origin.y) * invCellSize, locator.lastRow);
+    if (fx0 > fx1 || fy0 > fy1) return;
+
+    std::size_t first = out.size();
+    for (int cy = static_cast<int>(fy0); cy <= static_cast<int>(fy1); ++cy) {
+        for (int cx = static_cast<int>(fx0); cx <= static_cast<int>(fx1); ++cx) {
+            unsigned int c = static_cast<unsigned int>(cy) * cols + cx;
+            for (const Entry* e = cellBegin(c); e != cellEnd(c); ++e) out.push_back(e->body);
+        }
+    }
+    std::sort(out.begin() + first, out.end());
+    out.erase(std::unique(out.begin() + first, out.end()), out.end());
+}
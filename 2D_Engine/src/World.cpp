@@ -1,34 +1,52 @@
 #include "World.h"
-#include "Collision.h"
+#include <utility>
 
 void World::addRigidBody(RigidBody* body)
 {
+    if (body->isStatic) staticGrid.add(body);
     bodies.push_back(body);
 }
 
+void World::queryStatic(const Vector2& min, const Vector2& max, std::vector<RigidBody*>& out) const
+{
+    staticGrid.query(min, max, out);
+}
+
 void World::update(float dt)
 {
-    // reset collision flags
-    for (auto* b : bodies) b->isColliding = false;
+    std::swap(previousContacts, contacts);
+    contacts.clear();
+
+    // accumulate field forces, then integrate
+    forceFields.apply(bodies, dt);
 
     // update bodies
     for (auto* b : bodies) b->update(dt);
 
     // pairwise collision detection & resolve
+    // (i, j) visited in ascending order, so contacts come out sorted by key
     for (size_t i = 0; i < bodies.size(); ++i) {
         for (size_t j = i+1; j < bodies.size(); ++j) {
             CollisionManifold m = checkCollision(*bodies[i], *bodies[j]);
             if (m.colliding) {
-                bodies[i]->isColliding = true;
-                bodies[j]->isColliding = true;
-                resolveCollision(*bodies[i], *bodies[j], m);
+                ContactPair p;
+                p.key = (static_cast<unsigned long long>(i) << 32) | static_cast<unsigned long long>(j);
+                p.contact.a = bodies[i];
+                p.contact.b = bodies[j];
+                p.contact.normal = m.normal;
+                p.contact.penetration = m.penetration;
+                p.contact.impulse = resolveCollision(*bodies[i], *bodies[j], m);
+                contacts.push_back(p);
             }
         }
     }
 
-    // simple boundary screen clamp (optional)
-    const float left = 0.f, top = 0.f, right = 800.f, bottom = 600.f;
+    buildContactEvents();
+
+    // simple boundary screen clamp (optional); static bodies stay where they were added
+    const float left = 0.f, top = 0.f, right = Config::WORLD_WIDTH, bottom = Config::WORLD_HEIGHT;
     for (auto* b : bodies) {
+        if (b->isStatic) continue;
         Vector2 pos = b->getPosition();
         if (pos.x < left) { pos.x = left; b->velocity.x *= -b->restitution; }
         if (pos.x > right) { pos.x = right; b->velocity.x *= -b->restitution; }
@@ -37,3 +55,27 @@ void World::update(float dt)
         b->setPosition(pos);
     }
 }
+
+// merge this step's pairs against last step's: new -> Begin, both -> Persist, old only -> End
+void World::buildContactEvents()
+{
+    contactEvents.clear();
+    size_t i = 0, j = 0;
+    while (i < contacts.size() || j < previousContacts.size()) {
+        if (j == previousContacts.size() || (i < contacts.size() && contacts[i].key < previousContacts[j].key)) {
+            contactEvents.push_back(contacts[i].contact);
+            contactEvents.back().type = ContactEventType::Begin;
+            ++i;
+        } else if (i == contacts.size() || previousContacts[j].key < contacts[i].key) {
+            contactEvents.push_back(previousContacts[j].contact);
+            contactEvents.back().type = ContactEventType::End;
+            contactEvents.back().impulse = 0.f;
+            ++j;
+        } else {
+            contactEvents.push_back(contacts[i].contact);
+            contactEvents.back().type = ContactEventType::Persist;
+            ++i;
+            ++j;
+        }
+    }
+}
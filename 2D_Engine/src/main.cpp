@@ -1,5 +1,6 @@
 #include <SFML/Graphics.hpp>
 #include <iostream>
+#include <unordered_set>
 #include "World.h"
 #include "CircleShape.h"
 #include "RectangleShape.h"
@@ -43,6 +44,8 @@ int main()
         s->getWorld().addRigidBody(rc1);
         s->getWorld().addRigidBody(rc2);
         s->getWorld().addRigidBody(rb1);
+        // wind zone blowing left over the right half of the floor
+        s->getWorld().getForceFields().addField(ForceField::wind({600.f, 450.f}, 150.f, {-1.f, 0.f}, 1500.f));
         // store owned pointers in scene by calling init() path would normally own them; but for simplicity, let scene destructor not remove these (we used new).
         // For this simplified demo, avoid calling scene->init(); just push the scene
         sceneManager.addScene(std::move(s));
@@ -70,12 +73,30 @@ int main()
         {
             if (event.type == sf::Event::Closed) window.close();
 
+            if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left) {
+                // spray of sparks at the click position
+                Scene* active = sceneManager.getActive();
+                if (active) {
+                    Vector2 at{(float)event.mouseButton.x, (float)event.mouseButton.y};
+                    active->getParticles().burst(at, 5000, 400.f, 3.f, sf::Color(255, 180, 60));
+                }
+            }
+
             if (event.type == sf::Event::KeyPressed) {
                 if (event.key.code == sf::Keyboard::D) debugMode = !debugMode;
                 if (event.key.code == sf::Keyboard::P) paused = !paused;
                 if (event.key.code == sf::Keyboard::O) stepOnce = true; // step one frame
                 if (event.key.code == sf::Keyboard::Num1) sceneManager.setActive(0);
                 if (event.key.code == sf::Keyboard::Num2) { if (sceneManager.sceneCount() > 1) sceneManager.setActive(1); }
+                if (event.key.code == sf::Keyboard::E) {
+                    // short-lived explosion at the mouse cursor
+                    Scene* active = sceneManager.getActive();
+                    if (active) {
+                        sf::Vector2i mouse = sf::Mouse::getPosition(window);
+                        active->getWorld().getForceFields().addField(
+                            ForceField::explosion({(float)mouse.x, (float)mouse.y}, 200.f, 20000.f));
+                    }
+                }
                 if (event.key.code == sf::Keyboard::Space) {
                     // apply impulse to first dynamic circle found in active scene
                     Scene* active = sceneManager.getActive();
@@ -112,6 +133,18 @@ int main()
             }
         }
 
+        // bodies touching something this step, from the world's contact events
+        std::unordered_set<const RigidBody*> touching;
+        int contactCount = 0;
+        if (activeScene) {
+            for (const auto& e : activeScene->getWorld().getContactEvents()) {
+                if (e.type == ContactEventType::End) continue;
+                touching.insert(e.a);
+                touching.insert(e.b);
+                ++contactCount;
+            }
+        }
+
         window.clear(sf::Color::Black);
 
         // Render active scene
@@ -119,7 +152,7 @@ int main()
             const auto& bodies = activeScene->getWorld().getBodies();
             for (auto* b : bodies) {
                 // color: red if colliding, else shape default
-                sf::Color drawColor = b->isColliding ? sf::Color::Red : b->shape->color;
+                sf::Color drawColor = touching.count(b) ? sf::Color::Red : b->shape->color;
                 b->shape->render(window, drawColor, debugMode);
 
                 if (debugMode) {
@@ -135,11 +168,12 @@ int main()
                     window.draw(arrow);
                 }
             }
+            activeScene->getParticles().render(window);
         }
 
         // HUD
         // Draw a semi-transparent background for HUD
-        sf::RectangleShape hudBg(sf::Vector2f(240.f, 80.f));
+        sf::RectangleShape hudBg(sf::Vector2f(240.f, 96.f));
         hudBg.setPosition(8.f, 8.f);
         hudBg.setFillColor(sf::Color(0, 0, 0, 120));
         window.draw(hudBg);
@@ -154,6 +188,8 @@ int main()
             hud += "\nFPS: " + std::to_string(currentFPS);
             int count = activeScene ? (int)activeScene->getWorld().getBodies().size() : 0;
             hud += "\nObjects: " + std::to_string(count);
+            hud += "  Contacts: " + std::to_string(contactCount);
+            hud += "\nParticles: " + std::to_string(activeScene ? activeScene->getParticles().size() : 0);
             hud += "\nDebug(D): " + std::string(debugMode ? "ON" : "OFF");
             hud += "  Pause(P): " + std::string(paused ? "PAUSED" : "RUN");
             t.setString(hud);
@@ -164,8 +200,8 @@ int main()
             help.setFont(font);
             help.setCharacterSize(12);
             help.setFillColor(sf::Color(200,200,200));
-            help.setString("Space: impulse | 1/2: switch scenes | O: step 1 frame");
-            help.setPosition(12.f, 64.f);
+            help.setString("Space: impulse | E: explode | Click: sparks | O: step");
+            help.setPosition(12.f, 80.f);
             window.draw(help);
         } else {
             // minimal HUD without font